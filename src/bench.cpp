@@ -0,0 +1,321 @@
+#define DIM 2
+
+//
+// Benchmark suite.
+//
+// Usage: bin/bench [--min N] [--max N] [--format csv|json] [--output FILE] [--threads N]
+//
+// For each element type this times
+//
+//   kernel.*    per-element W, DW and DDW throughput through the element
+//               itself, the cached geometry, and batched evaluation
+//   vtk.write   Mesh::Unstructured::Print
+//   vtk.read    the Mesh::Unstructured file constructor
+//   prepare     coloring and batched geometry (prepare.batches, all that the
+//               matrix-free path needs), plus sparsity pattern and scatter maps
+//   memory.*    data held for the matrix-free path (the mesh's batched
+//               geometry) and for assembly (that, the pattern, and K), in MB
+//   assemble    stiffness matrix and residual assembly
+//   hessian     one matrix-free stiffness matrix application
+//   vtu.*       field output: the snapshot copy (the only part a solver
+//               waits for with IO::VTU::Writer) and binary .vtu writing
+//   solve       Jacobi-preconditioned CG on the clamped assembled system
+//               (unit "iterations (not converged)" if it did not converge)
+//
+// on generated square meshes of --min to --max elements (default 1e3 to
+// 1e5, in factors of 10), both structured and unstructured (perturbed and
+// randomly numbered), the latter also after RCM renumbering.
+// Results are written as CSV (default) or JSON to stdout or --output.
+//
+
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "eigen3/Eigen/Core"
+#include "eigen3/Eigen/Dense"
+#include "Set/Set.H"
+#include "Element/CST.H"
+#include "Element/LST.H"
+#include "Element/Q4.H"
+#include "Element/Q9.H"
+#include "Element/Geometry.H"
+#include "Element/Batch.H"
+#include "Model/Isotropic.H"
+#include "Mesh/Unstructured.H"
+#include "Mesh/MatrixFree.H"
+#include "Mesh/Generate.H"
+#include "Util/Parallel.H"
+
+using MODEL = Model::Isotropic;
+
+struct Result
+{
+    std::string benchmark, element, mesh, ordering;
+    long elements, dofs;
+    double seconds, value;
+    std::string unit;
+};
+
+std::vector<Result> results;
+
+//
+// Best time per call of f over enough calls to take at least
+// "minimum" seconds in total (and at least one call).
+//
+template<class F>
+double Time(F &&f, double minimum = 0.2)
+{
+    double best = std::numeric_limits<double>::max(), total = 0.0;
+    while (total < minimum || best == std::numeric_limits<double>::max())
+    {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        best = std::min(best, seconds);
+        total += seconds;
+    }
+    return best;
+}
+
+void Record(std::string benchmark, std::string element, std::string mesh, std::string ordering,
+            long elements, long dofs, double seconds, double value, std::string unit)
+{
+    results.push_back({benchmark, element, mesh, ordering, elements, dofs, seconds, value, unit});
+    std::cerr << benchmark << " " << element << " " << mesh << " " << ordering << " " << elements
+              << ": " << seconds << " s, " << value << " " << unit << std::endl;
+}
+
+//
+// Throughput of W, DW and DDW through the three evaluation paths, on a
+// sample of elements taken from an unstructured mesh.
+//
+template<class ELEMENT>
+void Kernels(std::string name, std::vector<ELEMENT> &elems)
+{
+    const int N = ELEMENT::_N, Q = ELEMENT::_Q;
+    using BATCH = Element::Batch<N,Q>;
+    const int B = BATCH::_B;
+    const long nelem = elems.size() / B * B;
+    MODEL model;
+
+    std::vector<std::array<Set::Vector,N>> u(nelem);
+    for (auto &ue : u) for (auto &un : ue) un = 0.01 * Set::Vector::Random();
+
+    std::vector<Element::Geometry<N,Q>> geom;
+    for (long e = 0; e < nelem; e++) geom.emplace_back(elems[e]);
+    struct Displacements {alignas(64) typename BATCH::Nodal u;};
+    std::vector<BATCH> batches(nelem / B);
+    std::vector<Displacements> ub(nelem / B);
+    for (long k = 0; k < nelem / B; k++)
+        for (int b = 0; b < B; b++)
+        {
+            batches[k].Load(b, geom[k*B+b]);
+            for (int n = 0; n < N; n++)
+                for (int i = 0; i < DIM; i++)
+                    ub[k].u[n][i][b] = u[k*B+b][n](i);
+        }
+
+    volatile double sink = 0.0;
+    auto record = [&](std::string path, std::string function, double seconds)
+    {
+        Record("kernel." + path + "." + function, name, "sample", "none", nelem, 0, seconds, nelem / seconds, "elements/s");
+    };
+
+    record("element", "W",   Time([&]() {for (long e = 0; e < nelem; e++) sink = sink + elems[e].W(u[e]);}));
+    record("element", "DW",  Time([&]() {for (long e = 0; e < nelem; e++) sink = sink + elems[e].DW(u[e])[0](0);}));
+    record("element", "DDW", Time([&]() {for (long e = 0; e < nelem; e++) sink = sink + elems[e].DDW(u[e])[0][0](0,0);}));
+
+    record("cached", "W",   Time([&]() {for (long e = 0; e < nelem; e++) sink = sink + geom[e].W(model,u[e]);}));
+    record("cached", "DW",  Time([&]() {for (long e = 0; e < nelem; e++) sink = sink + geom[e].DW(model,u[e])[0](0);}));
+    record("cached", "DDW", Time([&]() {for (long e = 0; e < nelem; e++) sink = sink + geom[e].DDW(model,u[e])[0][0](0,0);}));
+
+    typename BATCH::Scalars w;
+    typename BATCH::Nodal dw;
+    typename BATCH::Hessian ddw;
+    record("batched", "W",   Time([&]() {for (long k = 0; k < nelem/B; k++) {batches[k].W(model,ub[k].u,w); sink = sink + w[0];}}));
+    record("batched", "DW",  Time([&]() {for (long k = 0; k < nelem/B; k++) {batches[k].DW(model,ub[k].u,dw); sink = sink + dw[0][0][0];}}));
+    record("batched", "DDW", Time([&]() {for (long k = 0; k < nelem/B; k++) {batches[k].DDW(model,ub[k].u,ddw); sink = sink + ddw[0][0][0][0][0];}}));
+}
+
+//
+// Mesh-level benchmarks on one generated mesh.
+//
+void MeshBenchmarks(std::string name, Mesh::Unstructured<MODEL> &mesh, std::string kind, std::string ordering)
+{
+    const long nelem = mesh.nElements(), ndof = mesh.size();
+    auto record = [&](std::string benchmark, double seconds, double value, std::string unit)
+    {
+        Record(benchmark, name, kind, ordering, nelem, ndof, seconds, value, unit);
+    };
+
+    std::string vtkfile = (std::filesystem::temp_directory_path() / "fem-bench.vtk").string();
+    double seconds = Time([&]() {mesh.Print(vtkfile);}, 0.0);
+    double bytes = std::filesystem::file_size(vtkfile);
+    record("vtk.write", seconds, bytes / seconds / 1E6, "MB/s");
+    seconds = Time([&]() {Mesh::Unstructured<MODEL> read(vtkfile);}, 0.0);
+    record("vtk.read", seconds, bytes / seconds / 1E6, "MB/s");
+    std::filesystem::remove(vtkfile);
+
+    seconds = Time([&]() {mesh.PrepareBatches();}, 0.0);
+    record("prepare.batches", seconds, nelem / seconds, "elements/s");
+    record("memory.matrixfree", 0.0, mesh.Memory() / 1E6, "MB");
+    seconds = Time([&]() {mesh.Prepare();}, 0.0);
+    record("prepare", seconds, nelem / seconds, "elements/s");
+
+    Eigen::VectorXd u = 0.01 * Eigen::VectorXd::Random(ndof), R, y;
+    Eigen::SparseMatrix<Set::Scalar,Eigen::RowMajor> K;
+    mesh.Assemble(u,K,R);
+    double Kbytes = K.nonZeros() * (sizeof(Set::Scalar) + sizeof(int)) + (K.rows() + 1) * sizeof(int);
+    record("memory.assemble", 0.0, (mesh.Memory() + Kbytes) / 1E6, "MB");
+    seconds = Time([&]() {mesh.Assemble(u,K,R);});
+    record("assemble", seconds, nelem / seconds, "elements/s");
+
+    seconds = Time([&]() {mesh.Hessian(u,R,y);});
+    record("hessian", seconds, nelem / seconds, "elements/s");
+
+    seconds = Time([&]() {IO::VTU::Snapshot snapshot = mesh.Snapshot(u);}, 0.0);
+    record("vtu.snapshot", seconds, nelem / seconds, "elements/s");
+    std::string vtufile = (std::filesystem::temp_directory_path() / "fem-bench.vtu").string();
+    IO::VTU::Snapshot snapshot = mesh.Snapshot(u);
+    IO::VTU::Options options;
+    seconds = Time([&]() {IO::VTU::Write(snapshot, vtufile, options);}, 0.0);
+    record("vtu.write", seconds, std::filesystem::file_size(vtufile) / seconds / 1E6, "MB/s");
+#ifdef IO_VTU_ZLIB
+    options.compress = true;
+    seconds = Time([&]() {IO::VTU::Write(snapshot, vtufile, options);}, 0.0);
+    record("vtu.write.zlib", seconds, std::filesystem::file_size(vtufile) / seconds / 1E6, "MB/s");
+#endif
+    std::filesystem::remove(vtufile);
+
+    // Clamp the left edge, pull uniformly to the right, and solve K du = b
+    std::vector<int> fixed;
+    for (int p = 0; p < mesh.Points.size(); p++)
+        if (mesh.Points[p](0) < 1E-12) {fixed.push_back(2*p); fixed.push_back(2*p+1);}
+    Eigen::VectorXd b = Eigen::VectorXd::Zero(ndof);
+    for (int p = 0; p < mesh.Points.size(); p++) b(2*p) = 1.0 / mesh.Points.size();
+    Eigen::SparseMatrix<Set::Scalar,Eigen::RowMajor> Kc = K;
+    std::vector<char> isfixed(ndof,0);
+    for (int dof : fixed) {isfixed[dof] = 1; b(dof) = 0.0;}
+    for (int row = 0; row < ndof; row++)
+        for (Eigen::SparseMatrix<Set::Scalar,Eigen::RowMajor>::InnerIterator it(Kc,row); it; ++it)
+            if (isfixed[row] || isfixed[it.col()]) it.valueRef() = (row == it.col()) ? 1.0 : 0.0;
+
+    Eigen::ConjugateGradient<Eigen::SparseMatrix<Set::Scalar,Eigen::RowMajor>, Eigen::Lower|Eigen::Upper> cg;
+    cg.setTolerance(1E-8);
+    cg.setMaxIterations(2000);
+    Eigen::VectorXd du;
+    seconds = Time([&]() {cg.compute(Kc); du = cg.solve(b);}, 0.0);
+    // A solve that hit the iteration limit is not comparable with one
+    // that converged, so it is flagged in the unit column
+    record("solve", seconds, cg.iterations(),
+           cg.info() == Eigen::Success ? "iterations" : "iterations (not converged)");
+}
+
+template<class ELEMENT>
+void Run(std::string name, int type, long min, long max)
+{
+    {
+        Mesh::Unstructured<MODEL> sample = Mesh::Generate::Square<MODEL>(type, 1<<14, true);
+        if      constexpr (ELEMENT::_N == 3) Kernels(name, sample.CSTs);
+        else if constexpr (ELEMENT::_N == 4) Kernels(name, sample.Q4s);
+        else if constexpr (ELEMENT::_N == 6) Kernels(name, sample.LSTs);
+        else if constexpr (ELEMENT::_N == 9) Kernels(name, sample.Q9s);
+    }
+
+    for (long nelem = min; nelem <= max; nelem *= 10)
+    {
+        {
+            Mesh::Unstructured<MODEL> mesh = Mesh::Generate::Square<MODEL>(type, nelem, false);
+            MeshBenchmarks(name, mesh, "structured", "none");
+        }
+        {
+            Mesh::Unstructured<MODEL> mesh = Mesh::Generate::Square<MODEL>(type, nelem, true);
+            MeshBenchmarks(name, mesh, "unstructured", "none");
+            double seconds = Time([&]() {mesh.Renumber(Mesh::Unstructured<MODEL>::RCM);}, 0.0);
+            Record("renumber", name, "unstructured", "rcm", mesh.nElements(), mesh.size(), seconds,
+                   mesh.Bandwidth(), "bandwidth");
+            MeshBenchmarks(name, mesh, "unstructured", "rcm");
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    long min = 1000, max = 100000;
+    std::string format = "csv", output = "";
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return 1;
+        }
+        std::string value = argv[++i];
+        if      (arg == "--min")     min = std::stod(value);
+        else if (arg == "--max")     max = std::stod(value);
+        else if (arg == "--format")  format = value;
+        else if (arg == "--output")  output = value;
+        else if (arg == "--threads") Util::Parallel::Threads() = std::stoi(value);
+        else
+        {
+            std::cerr << "Unknown argument " << arg << std::endl;
+            return 1;
+        }
+    }
+    if (format != "csv" && format != "json")
+    {
+        std::cerr << "Format must be csv or json" << std::endl;
+        return 1;
+    }
+
+    srand(0);
+    Run<Element::CST<MODEL>>("cst", 5, min, max);
+    Run<Element::Q4<MODEL>>("q4", 9, min, max);
+    Run<Element::LST<MODEL>>("lst", 22, min, max);
+    Run<Element::Q9<MODEL>>("q9", 28, min, max);
+
+    std::ofstream file;
+    if (output != "") file.open(output);
+    std::ostream &out = (output != "") ? file : std::cout;
+    out.precision(6);
+
+    char date[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+    std::vector<std::pair<std::string,std::string>> meta = {
+        {"date", date},
+        {"compiler", __VERSION__},
+        {"threads", std::to_string(Util::Parallel::Threads())},
+        {"batch_width", std::to_string(ELEMENT_BATCH_WIDTH)}};
+
+    if (format == "csv")
+    {
+        for (auto &m : meta) out << "# " << m.first << "=" << m.second << "\n";
+        out << "benchmark,element,mesh,ordering,elements,dofs,seconds,value,unit\n";
+        for (const Result &r : results)
+            out << r.benchmark << "," << r.element << "," << r.mesh << "," << r.ordering << ","
+                << r.elements << "," << r.dofs << "," << r.seconds << "," << r.value << "," << r.unit << "\n";
+    }
+    else
+    {
+        out << "{\n  \"meta\": {";
+        for (int i = 0; i < meta.size(); i++)
+            out << (i ? ", " : "") << "\"" << meta[i].first << "\": \"" << meta[i].second << "\"";
+        out << "},\n  \"results\": [\n";
+        for (int i = 0; i < results.size(); i++)
+        {
+            const Result &r = results[i];
+            out << "    {\"benchmark\": \"" << r.benchmark << "\", \"element\": \"" << r.element
+                << "\", \"mesh\": \"" << r.mesh << "\", \"ordering\": \"" << r.ordering
+                << "\", \"elements\": " << r.elements << ", \"dofs\": " << r.dofs
+                << ", \"seconds\": " << r.seconds << ", \"value\": " << r.value
+                << ", \"unit\": \"" << r.unit << "\"}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n}\n";
+    }
+}
@@ -12,6 +12,8 @@
 #include "Model/Isotropic.H"
 #include "Model/Test.H"
 #include "Mesh/Unstructured.H"
+#include "Mesh/Test.H"
+#include "Solver/Test.H"
 
 
 int main(int argc, char **argv)
@@ -24,6 +26,10 @@ int main(int argc, char **argv)
     std::cout << "model.isotropic.derivative...";
     try {Model::Test<Model::Isotropic>::Derivative(); std::cout <<"pass"<<std::endl;}
     catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "model.isotropic.contraction...";
+    try {Model::Test<Model::Isotropic>::Contraction(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
     
     //
     // CST Tests
@@ -53,6 +59,18 @@ int main(int argc, char **argv)
     try {Element::Test<Element::CST<Model::Isotropic>>::EnergyDerivative(); std::cout <<"pass"<<std::endl;}
     catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
 
+    std::cout << "test.element.cst.cachedgeometry...";
+    try {Element::Test<Element::CST<Model::Isotropic>>::CachedGeometry<Model::Isotropic>(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.element.cst.batched...";
+    try {Element::Test<Element::CST<Model::Isotropic>>::Batched<Model::Isotropic>(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.element.cst.batchedhessian...";
+    try {Element::Test<Element::CST<Model::Isotropic>>::BatchedHessian<Model::Isotropic>(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
     //
     // LST Tests
     //
@@ -81,6 +99,18 @@ int main(int argc, char **argv)
     try {Element::Test<Element::LST<Model::Isotropic>>::EnergyDerivative(); std::cout <<"pass"<<std::endl;}
     catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
 
+    std::cout << "test.element.lst.cachedgeometry...";
+    try {Element::Test<Element::LST<Model::Isotropic>>::CachedGeometry<Model::Isotropic>(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.element.lst.batched...";
+    try {Element::Test<Element::LST<Model::Isotropic>>::Batched<Model::Isotropic>(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.element.lst.batchedhessian...";
+    try {Element::Test<Element::LST<Model::Isotropic>>::BatchedHessian<Model::Isotropic>(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
     //
     // Q4 Tests
     //
@@ -109,6 +139,18 @@ int main(int argc, char **argv)
     try {Element::Test<Element::Q4<Model::Isotropic>>::EnergyDerivative(); std::cout <<"pass"<<std::endl;}
     catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
 
+    std::cout << "test.element.q4.cachedgeometry...";
+    try {Element::Test<Element::Q4<Model::Isotropic>>::CachedGeometry<Model::Isotropic>(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.element.q4.batched...";
+    try {Element::Test<Element::Q4<Model::Isotropic>>::Batched<Model::Isotropic>(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.element.q4.batchedhessian...";
+    try {Element::Test<Element::Q4<Model::Isotropic>>::BatchedHessian<Model::Isotropic>(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
     //
     // Q9 Tests
     //
@@ -137,6 +179,185 @@ int main(int argc, char **argv)
     try {Element::Test<Element::Q9<Model::Isotropic>>::EnergyDerivative(); std::cout <<"pass"<<std::endl;}
     catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
 
+    std::cout << "test.element.q9.cachedgeometry...";
+    try {Element::Test<Element::Q9<Model::Isotropic>>::CachedGeometry<Model::Isotropic>(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.element.q9.batched...";
+    try {Element::Test<Element::Q9<Model::Isotropic>>::Batched<Model::Isotropic>(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.element.q9.batchedhessian...";
+    try {Element::Test<Element::Q9<Model::Isotropic>>::BatchedHessian<Model::Isotropic>(); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    //
+    // Mesh Tests
+    //
+
+    std::cout << "test.mesh.cst.binaryread...";
+    try {Mesh::Test<Model::Isotropic>::BinaryRead("cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.cst.assembly...";
+    try {Mesh::Test<Model::Isotropic>::Assembly("cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.cst.fan...";
+    try {Mesh::Test<Model::Isotropic>::Fan(100); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.cst.matrixfree...";
+    try {Mesh::Test<Model::Isotropic>::MatrixFreeOperator("cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.cst.matrixfreememory...";
+    try {Mesh::Test<Model::Isotropic>::MatrixFreeMemory("cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.cst.renumber.rcm...";
+    try {Mesh::Test<Model::Isotropic>::Renumbering("cst.vtk", Mesh::Unstructured<Model::Isotropic>::RCM); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.cst.renumber.hilbert...";
+    try {Mesh::Test<Model::Isotropic>::Renumbering("cst.vtk", Mesh::Unstructured<Model::Isotropic>::Hilbert); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.cst.vtuoutput...";
+    try {Mesh::Test<Model::Isotropic>::VTUOutput("cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.q4.binaryread...";
+    try {Mesh::Test<Model::Isotropic>::BinaryRead("q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.q4.assembly...";
+    try {Mesh::Test<Model::Isotropic>::Assembly("q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.q4.matrixfree...";
+    try {Mesh::Test<Model::Isotropic>::MatrixFreeOperator("q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.q4.matrixfreememory...";
+    try {Mesh::Test<Model::Isotropic>::MatrixFreeMemory("q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.q4.renumber.rcm...";
+    try {Mesh::Test<Model::Isotropic>::Renumbering("q4.vtk", Mesh::Unstructured<Model::Isotropic>::RCM); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.q4.renumber.hilbert...";
+    try {Mesh::Test<Model::Isotropic>::Renumbering("q4.vtk", Mesh::Unstructured<Model::Isotropic>::Hilbert); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.q4.vtuoutput...";
+    try {Mesh::Test<Model::Isotropic>::VTUOutput("q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.lst.binaryread...";
+    try {Mesh::Test<Model::Isotropic>::BinaryRead("lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.lst.assembly...";
+    try {Mesh::Test<Model::Isotropic>::Assembly("lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.lst.matrixfree...";
+    try {Mesh::Test<Model::Isotropic>::MatrixFreeOperator("lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.lst.matrixfreememory...";
+    try {Mesh::Test<Model::Isotropic>::MatrixFreeMemory("lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.lst.renumber.rcm...";
+    try {Mesh::Test<Model::Isotropic>::Renumbering("lst.vtk", Mesh::Unstructured<Model::Isotropic>::RCM); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.lst.renumber.hilbert...";
+    try {Mesh::Test<Model::Isotropic>::Renumbering("lst.vtk", Mesh::Unstructured<Model::Isotropic>::Hilbert); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.lst.vtuoutput...";
+    try {Mesh::Test<Model::Isotropic>::VTUOutput("lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.q9.binaryread...";
+    try {Mesh::Test<Model::Isotropic>::BinaryRead("q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.q9.assembly...";
+    try {Mesh::Test<Model::Isotropic>::Assembly("q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.q9.matrixfree...";
+    try {Mesh::Test<Model::Isotropic>::MatrixFreeOperator("q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.q9.matrixfreememory...";
+    try {Mesh::Test<Model::Isotropic>::MatrixFreeMemory("q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.q9.renumber.rcm...";
+    try {Mesh::Test<Model::Isotropic>::Renumbering("q9.vtk", Mesh::Unstructured<Model::Isotropic>::RCM); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.q9.renumber.hilbert...";
+    try {Mesh::Test<Model::Isotropic>::Renumbering("q9.vtk", Mesh::Unstructured<Model::Isotropic>::Hilbert); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.mesh.q9.vtuoutput...";
+    try {Mesh::Test<Model::Isotropic>::VTUOutput("q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.solver.cst.patch...";
+    try {Solver::Test<Model::Isotropic>::Patch("cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.solver.cst.options...";
+    try {Solver::Test<Model::Isotropic>::Options("cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.solver.cst.renumbered...";
+    try {Solver::Test<Model::Isotropic>::Renumbered("cst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.solver.q4.patch...";
+    try {Solver::Test<Model::Isotropic>::Patch("q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.solver.q4.options...";
+    try {Solver::Test<Model::Isotropic>::Options("q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.solver.q4.renumbered...";
+    try {Solver::Test<Model::Isotropic>::Renumbered("q4.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.solver.lst.patch...";
+    try {Solver::Test<Model::Isotropic>::Patch("lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.solver.lst.options...";
+    try {Solver::Test<Model::Isotropic>::Options("lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.solver.lst.renumbered...";
+    try {Solver::Test<Model::Isotropic>::Renumbered("lst.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.solver.q9.patch...";
+    try {Solver::Test<Model::Isotropic>::Patch("q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.solver.q9.options...";
+    try {Solver::Test<Model::Isotropic>::Options("q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
+
+    std::cout << "test.solver.q9.renumbered...";
+    try {Solver::Test<Model::Isotropic>::Renumbered("q9.vtk"); std::cout <<"pass"<<std::endl;}
+    catch(Util::Exception::UnitTest &e) {std::cout << "failed:" << std::endl << "   --> " << e.what() << std::endl;}
 
 
     //